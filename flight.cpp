@@ -1,9 +1,16 @@
 #include <iostream>
 #include <fstream>
+#include <cstdio>
 #include <string>
 #include <cstdlib>
 #include <ctime>
 #include <limits>
+#include <vector>
+#include <thread>
+#include <unordered_map>
+#include <deque>
+#include <map>
+#include <algorithm>
 using namespace std;
 
 // ===================== STRUCTS =====================
@@ -16,6 +23,7 @@ struct Flight {
     string date;            // YYYY-MM-DD
     string departureTime;   // HH:MM
     string arrivalTime;     // HH:MM
+    int fromCity, toCity;   // canonical city IDs (not stored in file)
 };
 
 struct Booking {
@@ -24,8 +32,9 @@ struct Booking {
     string phone;
     int flightID;
     string travellerName;
-    string status;          // PENDING / ACTIVE / CANCELLED
+    string status;          // PENDING / ACTIVE / CANCELLED / WAITLISTED
     string paymentMethod;   // CASH / CARD / ONLINE
+    int part;               // storage partition = its flight's month (not stored in file)
 };
 
 struct Passenger {
@@ -36,14 +45,22 @@ struct Passenger {
 };
 
 // ===================== GLOBAL ARRAYS =====================
-Flight flights[50];     int flightCount = 0;
-Booking bookings[50];   int bookingCount = 0;
+// flights/bookings hold only the resident storage partitions (see PARTITIONED STORAGE)
+vector<Flight> flights;
+vector<Booking> bookings;
 Passenger passengers[50];int passengerCount = 0;
 
 // ===================== CONSTANTS =====================
-const string ACTIVE="ACTIVE", CANCELLED="CANCELLED", PENDING="PENDING";
+const string ACTIVE="ACTIVE", CANCELLED="CANCELLED", PENDING="PENDING", WAITLISTED="WAITLISTED";
 const string CASH="CASH", CARD="CARD", ONLINE="ONLINE";
 
+// ID ranges. Flight IDs go up to 7 digits so large schedule imports can't run the
+// range dry; old 3-digit flight and 6-digit booking IDs stay valid inside them.
+const int FLIGHT_ID_MIN=100,     FLIGHT_ID_MAX=9999999;
+const int BOOKING_ID_MIN=100000, BOOKING_ID_MAX=9999999;
+const bool SEQUENTIAL_IDS=false;          // true: 100,101,...  false: shuffled order
+const bool REUSE_FREED_FLIGHT_IDS=false;  // hand out IDs of deleted flights again
+
 // ===================== SMALL HELPERS =====================
 void clearLine() { cin.ignore(numeric_limits<streamsize>::max(), '\n'); }
 
@@ -81,6 +98,14 @@ bool isValidDate(const string &d){
     return (day>=1 && day<=maxDay);
 }
 
+bool isValidMonth(const string &m){
+    return m.size()==7 && isValidDate(m+"-01");
+}
+
+bool isPositiveIntText(const string &s){
+    return isDigitsOnly(s) && s.size()<=9 && stoi(s)>0;
+}
+
 bool isValidTimeHHMM(const string &t){
     if(t.size()!=5 || t[2]!=':') return false;
     string hs=t.substr(0,2), ms=t.substr(3,2);
@@ -113,6 +138,858 @@ int getValidChoice(const string &msg,int mn,int mx){
     }
 }
 
+// ===================== ID ALLOCATOR =====================
+// Taken IDs are kept in a bitmap, so allocation never scans flights[]/bookings[].
+// Shuffled mode walks the range as  low + (offset + k*step) % size  with
+// gcd(step,size)==1, which visits every ID exactly once: no retries, no collisions.
+struct IDAllocator {
+    int low, high;
+    bool sequential, reuseFreed;
+    long long size, step, offset, cursor;
+    vector<unsigned char> used;     // 1 bit per ID in [low, high]
+    vector<int> freed;              // released IDs waiting for reuse
+    bool (*takenOnDisk)(int id);    // IDs stored in partitions that aren't loaded (may be null)
+    int checkDiskUpTo;              // higher IDs on disk were all issued by this sequence
+};
+
+IDAllocator flightIDs, bookingIDs;
+
+long long gcdLL(long long a,long long b){ return b==0 ? a : gcdLL(b, a%b); }
+
+long long bigRand(){ return ((long long)rand()<<15) ^ rand(); }
+
+void initIDAllocator(IDAllocator &a,int low,int high,bool sequential,bool reuseFreed){
+    a.low=low; a.high=high;
+    a.sequential=sequential; a.reuseFreed=reuseFreed;
+    a.size=(long long)high-low+1;
+    a.cursor=0;
+    a.offset=sequential ? 0 : bigRand()%a.size;
+    a.step=1;
+    if(!sequential && a.size>2){
+        do{ a.step=1 + bigRand()%(a.size-1); }while(gcdLL(a.step, a.size)!=1);
+    }
+    a.used.assign((size_t)((a.size+7)/8), 0);
+    a.freed.clear();
+    a.takenOnDisk=nullptr;
+    a.checkDiskUpTo=high;
+}
+
+bool isIDUsed(const IDAllocator &a,int id){
+    if(id<a.low || id>a.high) return false;
+    long long k=id-a.low;
+    return (a.used[(size_t)(k/8)] >> (k%8)) & 1;
+}
+
+void markIDUsed(IDAllocator &a,int id){
+    if(id<a.low || id>a.high) return;
+    long long k=id-a.low;
+    a.used[(size_t)(k/8)] |= (unsigned char)(1 << (k%8));
+}
+
+// Called once id is gone from disk too. Its bit may be clear (IDs loaded from a
+// partition are never marked), so the ID is queued either way.
+void releaseID(IDAllocator &a,int id){
+    if(!a.reuseFreed || id<a.low || id>a.high) return;
+    long long k=id-a.low;
+    a.used[(size_t)(k/8)] &= (unsigned char)~(1 << (k%8));
+    a.freed.push_back(id);
+}
+
+// Continues a sequence saved by an earlier run, so IDs it already handed out are
+// never visited again. A sequence saved for a different range is ignored (and
+// every ID is then checked on disk, as checkDiskUpTo stays at high).
+void restoreIDSequence(IDAllocator &a,long long offset,long long step,long long cursor,int checkUpTo){
+    if(offset<0 || offset>=a.size || step<1 || gcdLL(step, a.size)!=1 || cursor<0 || cursor>a.size) return;
+    a.offset=offset; a.step=step; a.cursor=cursor;
+    a.checkDiskUpTo=checkUpTo;
+}
+
+// Marks id taken and returns true if it is free. The cursor never revisits an ID
+// this sequence handed out, so only IDs up to checkDiskUpTo (the ones migrated
+// from before the sequence existed) need a look at the directory.
+bool claimID(IDAllocator &a,int id){
+    if(isIDUsed(a,id)) return false;
+    markIDUsed(a,id);
+    return !(a.takenOnDisk && id<=a.checkDiskUpTo && a.takenOnDisk(id));
+}
+
+// Returns -1 once every ID in the range is taken.
+int allocateID(IDAllocator &a){
+    while(!a.freed.empty()){
+        int id=a.freed.back(); a.freed.pop_back();
+        if(claimID(a,id)) return id;
+    }
+    // Each slot is visited once per run, so IDs already on disk cost O(1) each overall.
+    while(a.cursor < a.size){
+        long long k = a.sequential ? a.cursor : (a.offset + a.cursor*a.step) % a.size;
+        a.cursor++;
+        int id=(int)(a.low + k);
+        if(claimID(a,id)) return id;
+    }
+    return -1;
+}
+
+// ===================== WAITLIST =====================
+// flightID -> WAITLISTED booking IDs, oldest first. bookings_YYYY-MM.txt keeps rows in
+// creation order, so rebuilding the queues on load restores the FIFO order.
+unordered_map<int, deque<int> > waitlists;
+unordered_map<int, int> bookingPos;     // bookingID -> index in bookings[]
+
+void addBookingRecord(Booking b,int part){
+    b.part=part;
+    bookingPos[b.bookingID]=(int)bookings.size();
+    bookings.push_back(b);
+    if(b.status==WAITLISTED) waitlists[b.flightID].push_back(b.bookingID);
+}
+
+// 1-based place in the flight's queue, 0 if not waitlisted.
+int waitlistPosition(const Booking &b){
+    if(b.status!=WAITLISTED) return 0;
+    unordered_map<int, deque<int> >::iterator it=waitlists.find(b.flightID);
+    if(it==waitlists.end()) return 0;
+    for(size_t i=0;i<it->second.size();i++) if(it->second[i]==b.bookingID) return (int)i+1;
+    return 0;
+}
+
+// Puts a booking in its flight's queue at the place its row has in bookings[],
+// which is the order a reload of the file would give it.
+void joinWaitlist(Booking &b){
+    b.status=WAITLISTED;
+    deque<int> &q=waitlists[b.flightID];
+    int pos=bookingPos[b.bookingID];
+    size_t at=0;
+    while(at<q.size() && bookingPos[q[at]]<pos) at++;
+    q.insert(q.begin()+(long)at, b.bookingID);
+}
+
+void removeFromWaitlist(const Booking &b){
+    unordered_map<int, deque<int> >::iterator it=waitlists.find(b.flightID);
+    if(it==waitlists.end()) return;
+    for(size_t i=0;i<it->second.size();i++){
+        if(it->second[i]==b.bookingID){ it->second.erase(it->second.begin()+(long)i); break; }
+    }
+}
+
+// Gives free seats to the head of the queue; each promotion is O(1).
+// Caller saves bookings/flights.
+int promoteFromWaitlist(Flight *f){
+    unordered_map<int, deque<int> >::iterator it=waitlists.find(f->id);
+    if(it==waitlists.end()) return 0;
+    int promoted=0;
+    while(f->seats>0 && !it->second.empty()){
+        int bid=it->second.front(); it->second.pop_front();
+        Booking &b=bookings[bookingPos[bid]];
+        b.status=ACTIVE;
+        f->seats--;
+        promoted++;
+        cout<<"Waitlisted booking "<<bid<<" ("<<b.travellerName<<") promoted to ACTIVE.\n";
+    }
+    return promoted;
+}
+
+// ===================== CITY DICTIONARY =====================
+// Every city gets one canonical ID. Names are matched after normalizing
+// (lowercase, '_' -> ' ', trimmed, single spaces) through a trie, so an exact
+// or prefix lookup costs one small-map hop per character.
+struct CityNode {
+    map<char,int> child;            // any character except '|' (the file delimiter)
+    int city;                       // city ending exactly here, or -1
+    int firstCity;                  // alphabetically first city below this node
+    int cities;                     // number of cities below this node
+};
+
+vector<string> cityNames;           // canonical display name per city ID
+vector<CityNode> cityTrie;
+
+int newCityNode(){
+    CityNode n;
+    n.city=n.firstCity=-1; n.cities=0;
+    cityTrie.push_back(n);
+    return (int)cityTrie.size()-1;
+}
+
+// Trims, collapses spaces and turns '_' into ' ' (keeps the user's casing).
+string tidyCity(const string &s){
+    string out;
+    bool pendingSpace=false;
+    for(char c: s){
+        if(c=='_' || c==' ' || c=='\t'){ pendingSpace=!out.empty(); continue; }
+        if(pendingSpace){ out.push_back(' '); pendingSpace=false; }
+        out.push_back(c);
+    }
+    return out;
+}
+
+// Lookup key for a city name; "" if it is empty or holds '|' / control characters.
+string normalizeCity(const string &s){
+    string key=tidyCity(s);
+    for(char &c: key){
+        if(c>='A' && c<='Z') c=(char)(c-'A'+'a');
+        if(c=='|' || (c>=0 && c<' ')) return "";
+    }
+    return key;
+}
+
+// Node reached by walking the key, or -1.
+int findCityNode(const string &key){
+    if(cityTrie.empty()) return -1;
+    int node=0;
+    for(char c: key){
+        map<char,int>::const_iterator it=cityTrie[node].child.find(c);
+        if(it==cityTrie[node].child.end()) return -1;
+        node=it->second;
+    }
+    return node;
+}
+
+int findCityExact(const string &name){
+    string key=normalizeCity(name);
+    if(key.empty()) return -1;
+    int node=findCityNode(key);
+    return node==-1 ? -1 : cityTrie[node].city;
+}
+
+// Returns the city ID for name, adding it if new; -1 if the name is invalid.
+int registerCity(const string &name){
+    string key=normalizeCity(name);
+    if(key.empty()) return -1;
+    int existing=findCityExact(key);
+    if(existing!=-1) return existing;
+
+    int id=(int)cityNames.size();
+    string display=tidyCity(name);
+    for(size_t i=0;i<display.size();i++){
+        if((i==0 || display[i-1]==' ') && display[i]>='a' && display[i]<='z') display[i]=(char)(display[i]-'a'+'A');
+    }
+    cityNames.push_back(display);
+    if(cityTrie.empty()) newCityNode();
+
+    int node=0;
+    for(size_t i=0;i<=key.size();i++){
+        CityNode &n=cityTrie[node];
+        n.cities++;
+        if(n.firstCity==-1 || normalizeCity(cityNames[n.firstCity]) > key) n.firstCity=id;
+        if(i==key.size()) break;
+        if(!n.child.count(key[i])){ int c=newCityNode(); cityTrie[node].child[key[i]]=c; }
+        node=cityTrie[node].child[key[i]];
+    }
+    cityTrie[node].city=id;
+    return id;
+}
+
+// Collects up to limit city IDs below node, in alphabetical order.
+void collectCities(int node, vector<int> &out, size_t limit){
+    if(node==-1 || out.size()>=limit) return;
+    if(cityTrie[node].city!=-1) out.push_back(cityTrie[node].city);
+    for(map<char,int>::const_iterator it=cityTrie[node].child.begin();it!=cityTrie[node].child.end();++it){
+        collectCities(it->second, out, limit);
+    }
+}
+
+// Exact match, else the only city starting with name; otherwise -1 and
+// suggestions holds the candidates (empty if nothing matches).
+int resolveCity(const string &name, vector<int> &suggestions){
+    suggestions.clear();
+    string key=normalizeCity(name);
+    if(key.empty()) return -1;
+    int node=findCityNode(key);
+    if(node==-1) return -1;
+    if(cityTrie[node].city!=-1) return cityTrie[node].city;
+    if(cityTrie[node].cities==1) return cityTrie[node].firstCity;
+    collectCities(node, suggestions, 5);
+    return -1;
+}
+
+// ===================== TRAVEL PLANS (INTERVAL INDEX) =====================
+// Per traveller, the departure-arrival windows of live bookings (PENDING / ACTIVE /
+// WAITLISTED) in resident partitions, ordered by departure. Windows may overlap (an
+// admin edit can cause that), so a check does not rely on them being disjoint: every
+// window is at most MAX_FLIGHT_MINUTES long, so anything overlapping [start, end)
+// must depart in (start - MAX_FLIGHT_MINUTES, end). That is one O(log n) seek plus a
+// walk over the traveller's trips within about a day.
+const long long MAX_FLIGHT_MINUTES=1440;
+struct Stay {
+    long long end;          // minutes, exclusive
+    int bookingID;
+};
+
+unordered_map<string, multimap<long long, Stay> > travelPlans;
+
+// Days since 1970-01-01 (civil calendar).
+long long daysFromCivil(int y,int m,int d){
+    y -= m<=2;
+    long long era = (y>=0 ? y : y-399) / 400;
+    long long yoe = y - era*400;
+    long long doy = (153*(m + (m>2 ? -3 : 9)) + 2)/5 + d-1;
+    long long doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe - 719468;
+}
+
+long long minutesOf(const string &date,const string &hhmm){
+    long long day=daysFromCivil(stoi(date.substr(0,4)), stoi(date.substr(5,2)), stoi(date.substr(8,2)));
+    return day*1440 + stoi(hhmm.substr(0,2))*60 + stoi(hhmm.substr(3,2));
+}
+
+// Arrival at or before departure means the flight lands the next day,
+// so a window is never longer than MAX_FLIGHT_MINUTES.
+void flightWindow(const Flight &f,long long &start,long long &end){
+    start=minutesOf(f.date, f.departureTime);
+    end=minutesOf(f.date, f.arrivalTime);
+    if(end<=start) end+=1440;
+}
+
+bool isLiveBooking(const Booking &b){
+    return b.status==PENDING || b.status==ACTIVE || b.status==WAITLISTED;
+}
+
+// Person names compare trimmed, with single spaces and case-insensitively.
+string normalizePersonName(const string &name){
+    string out;
+    bool pendingSpace=false;
+    for(char c: name){
+        if(c==' ' || c=='\t'){ pendingSpace=!out.empty(); continue; }
+        if(pendingSpace){ out.push_back(' '); pendingSpace=false; }
+        out.push_back((c>='A' && c<='Z') ? (char)(c-'A'+'a') : c);
+    }
+    return out;
+}
+
+string travellerKey(const string &phone,const string &travellerName){
+    return phone+"|"+normalizePersonName(travellerName);
+}
+
+void addStay(const Booking &b,const Flight &f){
+    if(!isLiveBooking(b)) return;
+    long long start,end;
+    flightWindow(f,start,end);
+    Stay st={end, b.bookingID};
+    travelPlans[travellerKey(b.phone, b.travellerName)].insert(make_pair(start, st));
+}
+
+void removeStay(const Booking &b,const Flight &f){
+    string key=travellerKey(b.phone, b.travellerName);
+    unordered_map<string, multimap<long long, Stay> >::iterator plan=travelPlans.find(key);
+    if(plan==travelPlans.end()) return;
+    long long start,end;
+    flightWindow(f,start,end);
+    multimap<long long, Stay>::iterator it=plan->second.lower_bound(start);
+    for(;it!=plan->second.end() && it->first==start;++it){
+        if(it->second.bookingID==b.bookingID){ plan->second.erase(it); break; }
+    }
+    if(plan->second.empty()) travelPlans.erase(plan);
+}
+
+// Booking ID of a stay overlapping f's window for this traveller, or 0.
+// ignoreBookingID lets a booking be checked against everyone but itself.
+int findScheduleConflict(const string &phone,const string &travellerName,const Flight &f,int ignoreBookingID){
+    unordered_map<string, multimap<long long, Stay> >::iterator plan=travelPlans.find(travellerKey(phone, travellerName));
+    if(plan==travelPlans.end()) return 0;
+    long long start,end;
+    flightWindow(f,start,end);
+    multimap<long long, Stay>::iterator it=plan->second.upper_bound(start-MAX_FLIGHT_MINUTES);
+    for(;it!=plan->second.end() && it->first<end;++it){
+        if(it->second.bookingID==ignoreBookingID) continue;
+        if(it->second.end>start) return it->second.bookingID;
+    }
+    return 0;
+}
+
+// ===================== FILE OPS (PARTITIONED STORAGE) =====================
+// Flights and their bookings are stored per flight month (Flight::date):
+//   flights_YYYY-MM.txt / bookings_YYYY-MM.txt  same line formats as the old flights.txt / bookings.txt
+//   manifest.txt       partitions, city list, flight / booking ID allocator state
+//   flight_index_N.txt / booking_index_N.txt   ID directory buckets, "id|YYYY-MM"
+// A partition is read only when a query touches it, and at most
+// MAX_RESIDENT_PARTITIONS stay in flights/bookings; the least recently used one
+// is saved and dropped first. usePartition() may move or drop rows, so
+// Flight*/Booking& taken before it must be looked up again afterwards.
+const int MAX_RESIDENT_PARTITIONS=3;
+
+struct Partition {
+    string month;               // YYYY-MM
+    int flightRows, bookingRows;
+    int pendingRows;            // PENDING bookings, so approval skips months without any
+    bool loaded;
+    bool flightsDirty, bookingsDirty;   // resident rows changed since the files were written
+    long long lastUse;
+};
+
+vector<Partition> partitions;
+unordered_map<string,int> partitionOf;      // month -> index in partitions
+long long useClock=0;
+
+// "accountName|phone" -> months holding that account's bookings, so a passenger's
+// history reads only their own months.
+unordered_map<string, map<string,bool> > accountMonths;
+
+void noteAccountMonth(const Booking &b,const string &month){
+    accountMonths[b.accountName+"|"+b.phone][month]=true;
+}
+
+string monthOf(const string &date){ return date.substr(0,7); }
+
+int flightPart(const Flight &f){ return partitionOf[monthOf(f.date)]; }
+
+int getPartition(const string &month){
+    unordered_map<string,int>::iterator it=partitionOf.find(month);
+    if(it!=partitionOf.end()) return it->second;
+    Partition p;
+    p.month=month; p.flightRows=p.bookingRows=p.pendingRows=0;
+    p.loaded=false;
+    p.flightsDirty=p.bookingsDirty=false;
+    p.lastUse=0;
+    partitions.push_back(p);
+    partitionOf[month]=(int)partitions.size()-1;
+    return (int)partitions.size()-1;
+}
+
+// Mutations call these so only changed partitions are rewritten on save/eviction.
+void flightsChanged(int p){ partitions[p].flightsDirty=true; }
+void bookingsChanged(int p){ partitions[p].bookingsDirty=true; }
+
+// Partition indices sorted by month, for views that walk all history.
+vector<int> partitionsByMonth(){
+    vector<int> order;
+    for(int i=0;i<(int)partitions.size();i++){
+        order.push_back(i);
+        for(int j=(int)order.size()-1;j>0 && partitions[order[j]].month<partitions[order[j-1]].month;j--){
+            swap(order[j], order[j-1]);
+        }
+    }
+    return order;
+}
+
+void loadFlightFile(const string &path){
+    ifstream file(path);
+    string line;
+    while(getline(file,line)){
+        if(line.empty()) continue;
+        string parts[8], temp; int pc=0;
+        for(char c: line){
+            if(c=='|'){ if(pc<8) parts[pc++]=temp; temp.clear(); }
+            else temp.push_back(c);
+        }
+        if(pc<7) continue;
+        parts[pc++]=temp;
+        if(pc!=8) continue;
+
+        Flight f;
+        f.id=stoi(parts[0]);
+        // a name the dictionary can't hold keeps its raw text and is just not searchable
+        f.fromCity=registerCity(parts[1]);
+        f.toCity=registerCity(parts[2]);
+        f.from = f.fromCity==-1 ? parts[1] : cityNames[f.fromCity];
+        f.to   = f.toCity==-1   ? parts[2] : cityNames[f.toCity];
+        f.seats=stoi(parts[3]);
+        f.price=stoi(parts[4]);
+        f.date=parts[5];
+        f.departureTime=parts[6];
+        f.arrivalTime=parts[7];
+        flights.push_back(f);
+    }
+}
+
+void loadBookingFile(const string &path,int part){
+    ifstream file(path);
+    string line;
+    while(getline(file,line)){
+        if(line.empty()) continue;
+        string parts[7], temp; int pc=0;
+        for(char c: line){
+            if(c=='|'){ if(pc<7) parts[pc++]=temp; temp.clear(); }
+            else temp.push_back(c);
+        }
+        if(pc<6) continue;
+        parts[pc++]=temp;
+        if(pc!=7) continue;
+
+        Booking b;
+        b.bookingID=stoi(parts[0]);
+        b.accountName=parts[1];
+        b.phone=parts[2];
+        b.flightID=stoi(parts[3]);
+        b.travellerName=parts[4];
+        b.status=parts[5];
+        b.paymentMethod=parts[6];
+        addBookingRecord(b, part);
+    }
+}
+
+void writePartitionFlights(int p){
+    ofstream file("flights_"+partitions[p].month+".txt");
+    int rows=0;
+    for(int i=0;i<(int)flights.size();i++){
+        if(monthOf(flights[i].date)!=partitions[p].month) continue;
+        file<<flights[i].id<<"|"<<flights[i].from<<"|"<<flights[i].to<<"|"
+            <<flights[i].seats<<"|"<<flights[i].price<<"|"<<flights[i].date<<"|"
+            <<flights[i].departureTime<<"|"<<flights[i].arrivalTime<<"\n";
+        rows++;
+    }
+    partitions[p].flightRows=rows;
+    partitions[p].flightsDirty=false;
+}
+
+void writePartitionBookings(int p){
+    ofstream file("bookings_"+partitions[p].month+".txt");
+    int rows=0, pending=0;
+    for(int i=0;i<(int)bookings.size();i++){
+        if(bookings[i].part!=p) continue;
+        if(bookings[i].status==PENDING) pending++;
+        file<<bookings[i].bookingID<<"|"<<bookings[i].accountName<<"|"<<bookings[i].phone<<"|"
+            <<bookings[i].flightID<<"|"<<bookings[i].travellerName<<"|"<<bookings[i].status<<"|"
+            <<bookings[i].paymentMethod<<"\n";
+        rows++;
+    }
+    partitions[p].bookingRows=rows;
+    partitions[p].pendingRows=pending;
+    partitions[p].bookingsDirty=false;
+}
+
+void saveManifest(){
+    ofstream file("manifest.txt");
+    for(int i: partitionsByMonth()){
+        file<<"P|"<<partitions[i].month<<"|"<<partitions[i].flightRows<<"|"<<partitions[i].bookingRows
+            <<"|"<<partitions[i].pendingRows<<"\n";
+    }
+    for(size_t i=0;i<cityNames.size();i++) file<<"C|"<<cityNames[i]<<"\n";
+    for(unordered_map<string, map<string,bool> >::iterator a=accountMonths.begin();a!=accountMonths.end();++a){
+        for(map<string,bool>::iterator m=a->second.begin();m!=a->second.end();++m) file<<"U|"<<a->first<<"|"<<m->first<<"\n";
+    }
+    file<<"F|"<<flightIDs.offset<<"|"<<flightIDs.step<<"|"<<flightIDs.cursor<<"|"<<flightIDs.checkDiskUpTo<<"\n";
+    for(int id: flightIDs.freed) file<<"D|"<<id<<"\n";
+    file<<"A|"<<bookingIDs.offset<<"|"<<bookingIDs.step<<"|"<<bookingIDs.cursor<<"|"<<bookingIDs.checkDiskUpTo<<"\n";
+}
+
+// Returns false if there is no manifest yet.
+bool loadManifest(){
+    ifstream file("manifest.txt");
+    if(!file) return false;
+    string line;
+    while(getline(file,line)){
+        if(line.size()<3 || line[1]!='|') continue;
+        string parts[4], temp; int pc=0;
+        for(size_t i=2;i<line.size();i++){
+            if(line[i]=='|'){ if(pc<4) parts[pc++]=temp; temp.clear(); }
+            else temp.push_back(line[i]);
+        }
+        if(pc<4) parts[pc++]=temp;
+
+        if(line[0]=='P' && pc>=3){
+            int p=getPartition(parts[0]);
+            partitions[p].flightRows=stoi(parts[1]);
+            partitions[p].bookingRows=stoi(parts[2]);
+            partitions[p].pendingRows = pc==4 ? stoi(parts[3]) : partitions[p].bookingRows;
+            partitions[p].loaded=false;
+        }else if(line[0]=='C' && pc==1){
+            registerCity(parts[0]);
+        }else if(line[0]=='U' && pc==3){
+            accountMonths[parts[0]+"|"+parts[1]][parts[2]]=true;
+        }else if((line[0]=='A' || line[0]=='F') && pc>=3){
+            // continue the same ID sequence, so IDs stored in unloaded partitions are never reissued
+            IDAllocator &a = line[0]=='A' ? bookingIDs : flightIDs;
+            restoreIDSequence(a, stoll(parts[0]), stoll(parts[1]), stoll(parts[2]), pc==4 ? stoi(parts[3]) : a.high);
+        }else if(line[0]=='D' && pc==1 && isDigitsOnly(parts[0])){
+            releaseID(flightIDs, stoi(parts[0]));
+        }
+    }
+    return true;
+}
+
+// ID directories: the month holding each flight / booking ID (flights keep their
+// entry after deletion while bookings point at them). IDs are split into buckets
+// of bucketSize consecutive IDs, one file each; a bucket is read on the first
+// lookup that lands in it and rewritten whole when it changes, so files hold only
+// current entries and startup reads none of them. Like partitions, at most
+// MAX_RESIDENT_BUCKETS stay loaded per directory (least recently used dropped first).
+const int MAX_RESIDENT_BUCKETS=8;
+
+struct IDDirectory {
+    string prefix;                                  // bucket b lives in prefix + b + ".txt"
+    int bucketSize;
+    unordered_map<int, map<int,string> > buckets;   // loaded buckets only
+    unordered_map<int, long long> lastUse;          // per loaded bucket
+    map<int,bool> changed;                          // buckets saveDirectory() must rewrite
+};
+
+IDDirectory flightDir={"flight_index_", 100000, {}, {}, {}};
+IDDirectory bookingDir={"booking_index_", 100000, {}, {}, {}};
+
+// The bucket holding id, read from disk if needed. Only valid until the next call.
+map<int,string> &directoryBucket(IDDirectory &d,int id){
+    int b=id/d.bucketSize;
+    d.lastUse[b]=++useClock;
+    unordered_map<int, map<int,string> >::iterator it=d.buckets.find(b);
+    if(it!=d.buckets.end()) return it->second;
+
+    // unsaved buckets are never dropped
+    while((int)d.buckets.size()>=MAX_RESIDENT_BUCKETS){
+        int lru=-1;
+        for(it=d.buckets.begin();it!=d.buckets.end();++it){
+            if(d.changed.count(it->first)) continue;
+            if(lru==-1 || d.lastUse[it->first]<d.lastUse[lru]) lru=it->first;
+        }
+        if(lru==-1) break;
+        d.buckets.erase(lru);
+        d.lastUse.erase(lru);
+    }
+
+    map<int,string> &bucket=d.buckets[b];
+    ifstream file(d.prefix+to_string(b)+".txt");
+    string line;
+    while(getline(file,line)){
+        size_t bar=line.find('|');
+        if(bar==string::npos || !isDigitsOnly(line.substr(0,bar))) continue;
+        bucket[stoi(line.substr(0,bar))]=line.substr(bar+1);
+    }
+    return bucket;
+}
+
+// Month holding id, or "" if it was never stored (or has been freed).
+string lookupMonth(IDDirectory &d,int id){
+    map<int,string> &bucket=directoryBucket(d,id);
+    map<int,string>::iterator it=bucket.find(id);
+    return it==bucket.end() ? "" : it->second;
+}
+
+// Files id under month ("" frees it) in memory; saveDirectory() writes it out.
+void fileID(IDDirectory &d,int id,const string &month){
+    map<int,string> &bucket=directoryBucket(d,id);
+    if(month.empty()) bucket.erase(id);
+    else bucket[id]=month;
+    d.changed[id/d.bucketSize]=true;
+}
+
+// Rewrites every changed bucket once. Call it after the partition files the
+// new entries point at have been written.
+void saveDirectory(IDDirectory &d){
+    for(map<int,bool>::iterator t=d.changed.begin();t!=d.changed.end();++t){
+        string path=d.prefix+to_string(t->first)+".txt";
+        map<int,string> &bucket=d.buckets[t->first];
+        if(bucket.empty()){ remove(path.c_str()); continue; }
+        ofstream file(path);
+        for(map<int,string>::iterator it=bucket.begin();it!=bucket.end();++it) file<<it->first<<"|"<<it->second<<"\n";
+    }
+    d.changed.clear();
+}
+
+void recordIDs(IDDirectory &d,const vector<int> &ids,const string &month){
+    for(int id: ids) fileID(d, id, month);
+    saveDirectory(d);
+}
+
+void indexFlight(int id,const string &month){ recordIDs(flightDir, vector<int>(1, id), month); }
+
+bool flightIDOnDisk(int id){ return !lookupMonth(flightDir, id).empty(); }
+bool bookingIDOnDisk(int id){ return !lookupMonth(bookingDir, id).empty(); }
+
+// Partition of a stored flight ID, or -1.
+int storedFlightPart(int id){
+    string month=lookupMonth(flightDir, id);
+    return month.empty() ? -1 : getPartition(month);
+}
+
+// Adds (or removes) the travel windows of partition p's bookings.
+void indexPartitionStays(int p,bool add){
+    unordered_map<int,int> flightAt;
+    for(int i=0;i<(int)flights.size();i++){
+        if(monthOf(flights[i].date)==partitions[p].month) flightAt[flights[i].id]=i;
+    }
+    for(int i=0;i<(int)bookings.size();i++){
+        if(bookings[i].part!=p || !flightAt.count(bookings[i].flightID)) continue;
+        const Flight &f=flights[flightAt[bookings[i].flightID]];
+        if(add) addStay(bookings[i], f);
+        else removeStay(bookings[i], f);
+    }
+}
+
+void dropPartition(int p){
+    if(partitions[p].flightsDirty) writePartitionFlights(p);
+    if(partitions[p].bookingsDirty) writePartitionBookings(p);
+    indexPartitionStays(p, false);
+
+    size_t keep=0;
+    for(size_t i=0;i<flights.size();i++){
+        if(monthOf(flights[i].date)==partitions[p].month){ waitlists.erase(flights[i].id); continue; }
+        flights[keep++]=flights[i];
+    }
+    flights.resize(keep);
+
+    keep=0;
+    bookingPos.clear();
+    for(size_t i=0;i<bookings.size();i++){
+        if(bookings[i].part==p) continue;
+        bookingPos[bookings[i].bookingID]=(int)keep;
+        bookings[keep++]=bookings[i];
+    }
+    bookings.resize(keep);
+    partitions[p].loaded=false;
+}
+
+void usePartition(int p){
+    partitions[p].lastUse=++useClock;
+    if(partitions[p].loaded) return;
+
+    while(true){
+        int resident=0, lru=-1;
+        for(int i=0;i<(int)partitions.size();i++){
+            if(!partitions[i].loaded) continue;
+            resident++;
+            if(lru==-1 || partitions[i].lastUse<partitions[lru].lastUse) lru=i;
+        }
+        if(resident<MAX_RESIDENT_PARTITIONS) break;
+        dropPartition(lru);
+    }
+
+    loadFlightFile("flights_"+partitions[p].month+".txt");
+    loadBookingFile("bookings_"+partitions[p].month+".txt", p);
+    partitions[p].loaded=true;
+    indexPartitionStays(p, true);
+}
+
+// Loads p for a walk over all bookings; false if it has none to look at.
+bool useBookingPartition(int p){
+    if(!partitions[p].loaded && partitions[p].bookingRows==0) return false;
+    usePartition(p);
+    return true;
+}
+
+// Loads the partition for a month if it exists; false if no flights were ever stored there.
+bool useMonth(const string &month){
+    unordered_map<string,int>::iterator it=partitionOf.find(month);
+    if(it==partitionOf.end()) return false;
+    usePartition(it->second);
+    return true;
+}
+
+string monthString(int y,int m){
+    if(m==0){ y--; m=12; }
+    if(m==13){ y++; m=1; }
+    string mm=to_string(m);
+    return to_string(y)+"-"+(m<10 ? "0"+mm : mm);
+}
+
+// Loads every month a flight on this date could overlap with (flights are < 24h,
+// so only the day before/after matters). Loads the date's own month last.
+void useTravelWindow(const string &date){
+    int y=stoi(date.substr(0,4)), m=stoi(date.substr(5,2)), d=stoi(date.substr(8,2));
+    if(d==1) useMonth(monthString(y, m-1));
+    if(d>=28) useMonth(monthString(y, m+1));
+    useMonth(monthOf(date));
+}
+
+void saveFlights(){
+    for(int i=0;i<(int)partitions.size();i++) if(partitions[i].loaded && partitions[i].flightsDirty) writePartitionFlights(i);
+    saveManifest();
+}
+
+void saveBookings(){
+    for(int i=0;i<(int)partitions.size();i++) if(partitions[i].loaded && partitions[i].bookingsDirty) writePartitionBookings(i);
+    saveManifest();
+}
+
+// Re-files a flight and its bookings under the partition of newDate's month.
+void moveFlight(int id,const string &newDate){
+    int from=storedFlightPart(id), to=getPartition(monthOf(newDate));
+    if(from==-1) return;
+    usePartition(from);
+
+    Flight moved;
+    size_t keep=0;
+    for(size_t i=0;i<flights.size();i++){
+        if(flights[i].id==id){ moved=flights[i]; continue; }
+        flights[keep++]=flights[i];
+    }
+    flights.resize(keep);
+    for(size_t i=0;i<bookings.size();i++) if(bookings[i].flightID==id) removeStay(bookings[i], moved);
+    moved.date=newDate;
+
+    vector<Booking> movedBookings;
+    vector<int> movedIDs;
+    keep=0;
+    bookingPos.clear();
+    for(size_t i=0;i<bookings.size();i++){
+        if(bookings[i].flightID==id){ movedBookings.push_back(bookings[i]); movedIDs.push_back(bookings[i].bookingID); continue; }
+        bookingPos[bookings[i].bookingID]=(int)keep;
+        bookings[keep++]=bookings[i];
+    }
+    bookings.resize(keep);
+    waitlists.erase(id);            // rebuilt in order by addBookingRecord below
+    flightsChanged(from);
+    bookingsChanged(from);
+
+    usePartition(to);
+    flights.push_back(moved);
+    for(size_t i=0;i<movedBookings.size();i++){
+        addBookingRecord(movedBookings[i], to);
+        addStay(movedBookings[i], moved);
+        noteAccountMonth(movedBookings[i], partitions[to].month);
+    }
+    flightsChanged(to);
+    if(!movedBookings.empty()) bookingsChanged(to);
+    saveFlights();
+    saveBookings();
+    indexFlight(id, monthOf(newDate));
+    recordIDs(bookingDir, movedIDs, monthOf(newDate));
+}
+
+// One-time split of the old single flights.txt / bookings.txt into month partitions.
+void migrateLegacyFiles(){
+    loadFlightFile("flights.txt");
+    unordered_map<int,int> legacyFlightPart;
+    map<string, vector<int> > flightIDsByMonth, bookingIDsByMonth;
+    for(size_t i=0;i<flights.size();i++){
+        legacyFlightPart[flights[i].id]=getPartition(monthOf(flights[i].date));
+        flightsChanged(legacyFlightPart[flights[i].id]);
+        flightIDsByMonth[monthOf(flights[i].date)].push_back(flights[i].id);
+    }
+
+    loadBookingFile("bookings.txt", -1);
+    for(size_t i=0;i<bookings.size();i++){
+        unordered_map<int,int>::iterator it=legacyFlightPart.find(bookings[i].flightID);
+        // bookings of already-deleted flights keep their IDs taken in a partition of their own
+        if(it==legacyFlightPart.end()){
+            flightIDsByMonth["0000-00"].push_back(bookings[i].flightID);
+            legacyFlightPart[bookings[i].flightID]=getPartition("0000-00");
+            it=legacyFlightPart.find(bookings[i].flightID);
+        }
+        bookings[i].part=it->second;
+        bookingsChanged(it->second);
+        bookingIDsByMonth[partitions[it->second].month].push_back(bookings[i].bookingID);
+        noteAccountMonth(bookings[i], partitions[it->second].month);
+    }
+
+    // everything on disk now is legacy; later IDs come from the saved sequences
+    flightIDs.checkDiskUpTo=flightIDs.low-1;
+    for(unordered_map<int,int>::iterator it=legacyFlightPart.begin();it!=legacyFlightPart.end();++it){
+        flightIDs.checkDiskUpTo=max(flightIDs.checkDiskUpTo, it->first);
+    }
+    bookingIDs.checkDiskUpTo=bookingIDs.low-1;
+    for(size_t i=0;i<bookings.size();i++) bookingIDs.checkDiskUpTo=max(bookingIDs.checkDiskUpTo, bookings[i].bookingID);
+
+    for(int i=0;i<(int)partitions.size();i++){ partitions[i].loaded=true; dropPartition(i); }
+    waitlists.clear();
+    for(map<string, vector<int> >::iterator it=flightIDsByMonth.begin();it!=flightIDsByMonth.end();++it) recordIDs(flightDir, it->second, it->first);
+    for(map<string, vector<int> >::iterator it=bookingIDsByMonth.begin();it!=bookingIDsByMonth.end();++it) recordIDs(bookingDir, it->second, it->first);
+    saveManifest();
+}
+
+void openStorage(){
+    if(!loadManifest()){
+        migrateLegacyFiles();
+        partitions.clear(); partitionOf.clear();
+        loadManifest();
+    }
+    // IDs are checked against the directories only when the allocator reaches them
+    flightIDs.takenOnDisk=flightIDOnDisk;
+    bookingIDs.takenOnDisk=bookingIDOnDisk;
+
+    // Warm the active window: this month's flights.
+    time_t now=time(nullptr);
+    char month[8];
+    strftime(month, sizeof(month), "%Y-%m", localtime(&now));
+    useMonth(month);
+}
+
 // ===================== REQUIRED MINIMIZERS =====================
 
 int runMenu(const string &title, const string options[], int n){
@@ -132,9 +1009,51 @@ string promptUntil(const string &msg, bool (*valid)(const string&), const string
     }
 }
 
+// Reads a city name with getline into name (the canonical spelling of a known city).
+// Search prompts accept a unique prefix ("isl" -> Islamabad). With allowNew an unknown
+// name is accepted but not added yet: NEW_CITY is returned and the caller registers
+// name once its flight is actually saved, so abandoned typos never reach the manifest.
+// Returns the city ID, NEW_CITY, or -1 for "0" (back).
+const int NEW_CITY=-2;
+
+int readCity(const string &msg, bool allowNew, string &name){
+    while(true){
+        cout << msg;
+        string in;
+        getline(cin, in);
+        if(tidyCity(in)=="0") return -1;
+        if(normalizeCity(in).empty()){ cout << "Invalid city name!\n"; continue; }
+
+        vector<int> matches;
+        int id = allowNew ? findCityExact(in) : resolveCity(in, matches);
+        if(id!=-1){
+            if(tidyCity(in)!=cityNames[id]) cout << "  -> " << cityNames[id] << "\n";
+            name=cityNames[id];
+            return id;
+        }
+        name=tidyCity(in);
+        if(allowNew){
+            int node=findCityNode(normalizeCity(in));
+            collectCities(node, matches, 5);
+            if(matches.empty()) return NEW_CITY;
+        }
+
+        if(matches.empty()){ cout << "Unknown city!\n"; continue; }
+        cout << "Did you mean:";
+        for(size_t i=0;i<matches.size();i++) cout << (i ? ", " : " ") << cityNames[matches[i]];
+        cout << "\n";
+        if(allowNew){
+            const string opts[]={"Type again","Add \"" + tidyCity(in) + "\" as a new city"};
+            int c=runMenu("New City?", opts, 2);
+            clearLine();
+            if(c==2) return NEW_CITY;
+        }
+    }
+}
+
 void printBooking(const Booking &b){
     Flight *f = nullptr;
-    for(int i=0;i<flightCount;i++) if(flights[i].id==b.flightID){ f=&flights[i]; break; }
+    for(int i=0;i<(int)flights.size();i++) if(flights[i].id==b.flightID){ f=&flights[i]; break; }
 
     cout << "BookingID: " << b.bookingID
          << " | Account: " << b.accountName
@@ -143,6 +1062,7 @@ void printBooking(const Booking &b){
          << " | Traveller: " << b.travellerName
          << " | Payment: " << b.paymentMethod
          << " | Status: " << b.status;
+    if(b.status==WAITLISTED) cout << " #" << waitlistPosition(b);
 
     if(f){
         cout << " | " << f->from << " -> " << f->to
@@ -165,117 +1085,68 @@ void displayFlight(const Flight &f){
 }
 
 
-void viewAllFlights(){
+// Walks every partition month by month; returns the number of flights shown.
+int viewAllFlights(){
     cout << "\n--- Available Flights ---\n";
-    if(flightCount==0){ cout<<"No flights available.\n"; return; }
-    for(int i=0;i<flightCount;i++) displayFlight(flights[i]);
+    int shown=0;
+    for(int p: partitionsByMonth()){
+        if(partitions[p].flightRows==0 && !partitions[p].loaded) continue;
+        usePartition(p);
+        for(int i=0;i<(int)flights.size();i++){
+            if(monthOf(flights[i].date)==partitions[p].month){ displayFlight(flights[i]); shown++; }
+        }
+    }
+    if(shown==0) cout<<"No flights available.\n";
+    return shown;
 }
 
+// Lists one month's flights; only that partition is loaded. Returns the number shown.
+int viewFlightsOfMonth(const string &month){
+    cout << "\n--- Available Flights (" << month << ") ---\n";
+    int shown=0;
+    if(useMonth(month)) for(int i=0;i<(int)flights.size();i++){
+        if(monthOf(flights[i].date)==month){ displayFlight(flights[i]); shown++; }
+    }
+    if(shown==0) cout<<"No flights available.\n";
+    return shown;
+}
+
+// Loads the flight's partition via the flight ID directory, so the result is only
+// valid until the next usePartition() call.
 Flight* findFlightByID(int id){
-    for(int i=0;i<flightCount;i++) if(flights[i].id==id) return &flights[i];
+    int part=storedFlightPart(id);
+    if(part==-1) return nullptr;
+    usePartition(part);
+    for(int i=0;i<(int)flights.size();i++) if(flights[i].id==id) return &flights[i];
     return nullptr;
 }
 
-bool bookingIDExists(int id){
-    for(int i=0;i<bookingCount;i++) if(bookings[i].bookingID==id) return true;
-    return false;
-}
-int generateUniqueBookingID(){
-    int id;
-    do{ id=100000 + (rand()%900000); }while(bookingIDExists(id));
-    return id;
+// Resident booking index for a booking ID, loading its month via the booking ID
+// directory; -1 if none.
+int findBookingIndex(int bid){
+    unordered_map<int,int>::iterator it=bookingPos.find(bid);
+    if(it!=bookingPos.end()) return it->second;
+    string month=lookupMonth(bookingDir, bid);
+    if(month.empty() || !useMonth(month)) return -1;
+    it=bookingPos.find(bid);
+    return it==bookingPos.end() ? -1 : it->second;
 }
 
-bool flightIDExists(int id){
-    for(int i=0;i<flightCount;i++) if(flights[i].id==id) return true;
-    return false;
-}
-int generateUniqueFlightID(){
-    int id;
-    do{ id=100 + (rand()%900); }while(flightIDExists(id));
-    return id;
-}
+int generateUniqueBookingID(){ return allocateID(bookingIDs); }
+int generateUniqueFlightID(){ return allocateID(flightIDs); }
 
-bool checkActiveBookingExists(const string &name,const string &phone,int flightID){
-    for(int i=0;i<bookingCount;i++){
+bool checkBookingExists(const string &name,const string &phone,int flightID,const string &status){
+    for(int i=0;i<(int)bookings.size();i++){
         if(bookings[i].accountName==name &&
            bookings[i].phone==phone &&
            bookings[i].flightID==flightID &&
-           bookings[i].status==ACTIVE) return true;
+           bookings[i].status==status) return true;
     }
     return false;
 }
 
-// ===================== FILE OPS =====================
-void loadFlights(){
-    ifstream file("flights.txt");
-    flightCount=0;
-    string line;
-    while(getline(file,line)){
-        if(line.empty() || flightCount>=50) continue;
-        string parts[8], temp; int pc=0;
-        for(char c: line){
-            if(c=='|'){ if(pc<8) parts[pc++]=temp; temp.clear(); }
-            else temp.push_back(c);
-        }
-        if(pc<7) continue;
-        parts[pc++]=temp;
-        if(pc!=8) continue;
-
-        flights[flightCount].id=stoi(parts[0]);
-        flights[flightCount].from=parts[1];
-        flights[flightCount].to=parts[2];
-        flights[flightCount].seats=stoi(parts[3]);
-        flights[flightCount].price=stoi(parts[4]);
-        flights[flightCount].date=parts[5];
-        flights[flightCount].departureTime=parts[6];
-        flights[flightCount].arrivalTime=parts[7];
-        flightCount++;
-    }
-}
-
-void saveFlights(){
-    ofstream file("flights.txt");
-    for(int i=0;i<flightCount;i++){
-        file<<flights[i].id<<"|"<<flights[i].from<<"|"<<flights[i].to<<"|"
-            <<flights[i].seats<<"|"<<flights[i].price<<"|"<<flights[i].date<<"|"
-            <<flights[i].departureTime<<"|"<<flights[i].arrivalTime<<"\n";
-    }
-}
-
-void loadBookings(){
-    ifstream file("bookings.txt");
-    bookingCount=0;
-    string line;
-    while(getline(file,line)){
-        if(line.empty() || bookingCount>=50) continue;
-        string parts[7], temp; int pc=0;
-        for(char c: line){
-            if(c=='|'){ if(pc<7) parts[pc++]=temp; temp.clear(); }
-            else temp.push_back(c);
-        }
-        if(pc<6) continue;
-        parts[pc++]=temp;
-        if(pc!=7) continue;
-
-        bookings[bookingCount].bookingID=stoi(parts[0]);
-        bookings[bookingCount].accountName=parts[1];
-        bookings[bookingCount].phone=parts[2];
-        bookings[bookingCount].flightID=stoi(parts[3]);
-        bookings[bookingCount].travellerName=parts[4];
-        bookings[bookingCount].status=parts[5];
-        bookings[bookingCount].paymentMethod=parts[6];
-        bookingCount++;
-    }
-}
-
-void saveBookings(){
-    ofstream file("bookings.txt");
-    for(int i=0;i<bookingCount;i++){
-        file<<bookings[i].bookingID<<"|"<<bookings[i].accountName<<"|"<<bookings[i].phone<<"|"
-            <<bookings[i].flightID<<"|"<<bookings[i].travellerName<<"|"<<bookings[i].status<<"|"
-            <<bookings[i].paymentMethod<<"\n";
-    }
+bool checkActiveBookingExists(const string &name,const string &phone,int flightID){
+    return checkBookingExists(name,phone,flightID,ACTIVE);
 }
 
 void loadPassengers(){
@@ -324,15 +1195,18 @@ bool adminLogin(){
 }
 
 void addFlight(){
-    if(flightCount>=50){ cout<<"Maximum flights reached!\n"; return; }
-
     Flight f;
     f.id=generateUniqueFlightID();
+    if(f.id==-1){ cout<<"No free Flight IDs left!\n"; return; }
     cout<<"\nGenerated Flight ID: "<<f.id<<"\n";
 
     clearLine();
-    cout<<"From (single word or use _ for spaces): "; getline(cin, f.from);
-    cout<<"To   (single word or use _ for spaces): "; getline(cin, f.to);
+    if(readCity("From (0 back): ", true, f.from)==-1) return;
+    while(true){
+        if(readCity("To   (0 back): ", true, f.to)==-1) return;
+        if(normalizeCity(f.to)!=normalizeCity(f.from)) break;
+        cout<<"From and To must be different cities!\n";
+    }
 
     f.seats=getValidInt("Seats: ");
     f.price=getValidInt("Price: ");
@@ -345,20 +1219,56 @@ void addFlight(){
     f.arrivalTime=promptUntil("Arrival   (HH:MM) (0 back): ", isValidTimeHHMM, "Invalid time!");
     if(f.arrivalTime=="0") return;
 
-    flights[flightCount++]=f;
+    f.fromCity=registerCity(f.from);
+    f.toCity=registerCity(f.to);
+    f.from=cityNames[f.fromCity];
+    f.to=cityNames[f.toCity];
+    int part=getPartition(monthOf(f.date));
+    usePartition(part);
+    flights.push_back(f);
+    flightsChanged(part);
     saveFlights();
+    indexFlight(f.id, monthOf(f.date));
     cout<<"Flight added successfully!\n";
 }
 
+// Applies a same-month date/time change to a resident flight and moves the
+// travel windows of its bookings with it.
+void retimeFlight(int id,const Flight &after){
+    useTravelWindow(after.date);
+    Flight *f=findFlightByID(id);
+    if(!f) return;
+    for(size_t i=0;i<bookings.size();i++){
+        if(bookings[i].flightID!=id) continue;
+        removeStay(bookings[i], *f);
+        addStay(bookings[i], after);
+    }
+    *f=after;
+    flightsChanged(flightPart(*f));
+}
+
+// Warns about travellers whose bookings on this flight now overlap another trip.
+void warnScheduleConflicts(int id){
+    Flight *f=findFlightByID(id);
+    if(!f) return;
+    useTravelWindow(f->date);
+    f=findFlightByID(id);
+    for(size_t i=0;i<bookings.size();i++){
+        if(bookings[i].flightID!=id || !isLiveBooking(bookings[i])) continue;
+        int clash=findScheduleConflict(bookings[i].phone, bookings[i].travellerName, *f, bookings[i].bookingID);
+        if(clash) cout<<"Warning: booking "<<bookings[i].bookingID<<" ("<<bookings[i].travellerName
+                      <<") now overlaps booking "<<clash<<".\n";
+    }
+}
+
 void editFlight(){
-    viewAllFlights();
-    if(flightCount==0) return;
+    string month=promptUntil("Month of the flight (YYYY-MM) (0 back): ", isValidMonth, "Invalid month!");
+    if(month=="0" || viewFlightsOfMonth(month)==0) return;
 
     int id=getValidInt("Enter Flight ID to edit (0 back): ");
     if(id==0) return;
 
-    Flight* f=findFlightByID(id);
-    if(!f){ cout<<"Flight not found!\n"; return; }
+    if(!findFlightByID(id)){ cout<<"Flight not found!\n"; return; }
 
     const string opts[]={
         "Edit From","Edit To","Edit Seats","Edit Price","Edit Date",
@@ -369,47 +1279,228 @@ void editFlight(){
         int c=runMenu("Edit Flight", opts, 8);
         if(c==8) break;
 
+        Flight* f=findFlightByID(id);
         switch(c){
-            case 1: clearLine(); cout<<"New From: "; getline(cin,f->from); break;
-            case 2: clearLine(); cout<<"New To: "; getline(cin,f->to); break;
-            case 3: f->seats=getValidInt("New Seats: "); break;
+            case 1:{
+                clearLine();
+                string name;
+                if(readCity("New From (0 back): ", true, name)==-1) break;
+                if(normalizeCity(name)==normalizeCity(f->to)){ cout<<"From and To must be different cities!\n"; break; }
+                f->fromCity=registerCity(name); f->from=cityNames[f->fromCity];
+                break;
+            }
+            case 2:{
+                clearLine();
+                string name;
+                if(readCity("New To (0 back): ", true, name)==-1) break;
+                if(normalizeCity(name)==normalizeCity(f->from)){ cout<<"From and To must be different cities!\n"; break; }
+                f->toCity=registerCity(name); f->to=cityNames[f->toCity];
+                break;
+            }
+            case 3:
+                f->seats=getValidInt("New Seats: ");
+                if(promoteFromWaitlist(f)>0){ bookingsChanged(flightPart(*f)); saveBookings(); }
+                break;
             case 4: f->price=getValidInt("New Price: "); break;
             case 5:{
                 string d=promptUntil("New Date (YYYY-MM-DD) (0 back): ", isValidDate, "Invalid date!");
-                if(d!="0") f->date=d;
+                if(d=="0") break;
+                if(monthOf(d)==monthOf(f->date)){ Flight after=*f; after.date=d; retimeFlight(id, after); }
+                else moveFlight(id, d);
+                warnScheduleConflicts(id);
                 break;
             }
             case 6:{
                 string t=promptUntil("New Departure (HH:MM) (0 back): ", isValidTimeHHMM, "Invalid time!");
-                if(t!="0") f->departureTime=t;
+                if(t!="0"){ Flight after=*f; after.departureTime=t; retimeFlight(id, after); warnScheduleConflicts(id); }
                 break;
             }
             case 7:{
                 string t=promptUntil("New Arrival (HH:MM) (0 back): ", isValidTimeHHMM, "Invalid time!");
-                if(t!="0") f->arrivalTime=t;
+                if(t!="0"){ Flight after=*f; after.arrivalTime=t; retimeFlight(id, after); warnScheduleConflicts(id); }
                 break;
             }
         }
+        Flight *edited=findFlightByID(id);
+        if(edited) flightsChanged(flightPart(*edited));
         saveFlights();
         cout<<"Updated!\n";
     }
 }
 
 void deleteFlight(){
-    viewAllFlights();
-    if(flightCount==0) return;
+    string month=promptUntil("Month of the flight (YYYY-MM) (0 back): ", isValidMonth, "Invalid month!");
+    if(month=="0" || viewFlightsOfMonth(month)==0) return;
 
     int id=getValidInt("Enter Flight ID to delete (0 back): ");
     if(id==0) return;
 
-    int idx=-1;
-    for(int i=0;i<flightCount;i++) if(flights[i].id==id){ idx=i; break; }
-    if(idx==-1){ cout<<"Flight not found!\n"; return; }
+    Flight* f=findFlightByID(id);
+    if(!f){ cout<<"Flight not found!\n"; return; }
+    int idx=(int)(f-&flights[0]);
+    int part=flightPart(*f);
+
+    // bookings live in the flight's partition, which findFlightByID just loaded
+    bool hasBookings=false;
+    int cancelled=0;
+    for(int i=0;i<(int)bookings.size();i++){
+        if(bookings[i].flightID!=id) continue;
+        hasBookings=true;
+        removeStay(bookings[i], *f);
+        if(isLiveBooking(bookings[i])){ bookings[i].status=CANCELLED; cancelled++; }
+    }
+    waitlists.erase(id);
 
-    for(int i=idx;i<flightCount-1;i++) flights[i]=flights[i+1];
-    flightCount--;
+    flights.erase(flights.begin()+idx);
+    flightsChanged(part);
+    if(cancelled>0) bookingsChanged(part);
     saveFlights();
+    saveBookings();
+    if(!hasBookings && flightIDs.reuseFreed){
+        indexFlight(id, "");
+        releaseID(flightIDs, id);
+        saveManifest();
+    }
     cout<<"Flight deleted successfully!\n";
+    if(cancelled>0) cout<<cancelled<<" booking(s) on this flight were cancelled.\n";
+}
+
+// ===================== BULK SCHEDULE IMPORT =====================
+// Schedule file: one flight per line, same layout as flights_YYYY-MM.txt minus the ID:
+//   from|to|seats|price|YYYY-MM-DD|HH:MM|HH:MM
+// Blank lines and lines starting with '#' are skipped.
+struct ImportRow {
+    int lineNo;
+    bool skip;              // blank / comment
+    string error;           // empty if the row is valid
+    string fields[7];
+};
+
+// Pure per-line checks, safe to run from several threads at once.
+void parseScheduleLine(const string &line, ImportRow &r){
+    r.skip = line.empty() || line[0]=='#';
+    if(r.skip) return;
+
+    string temp; int pc=0;
+    for(char c: line){
+        if(c=='|'){ if(pc<7) r.fields[pc]=temp; pc++; temp.clear(); }
+        else if(c!='\r') temp.push_back(c);
+    }
+    if(pc<7) r.fields[pc]=temp;
+    pc++;
+
+    if(pc!=7){ r.error="expected 7 fields, found "+to_string(pc); return; }
+    if(normalizeCity(r.fields[0]).empty()){ r.error="invalid from city"; return; }
+    if(normalizeCity(r.fields[1]).empty()){ r.error="invalid to city"; return; }
+    if(normalizeCity(r.fields[0])==normalizeCity(r.fields[1])){ r.error="from and to are the same city"; return; }
+    if(!isPositiveIntText(r.fields[2])){ r.error="seats must be a positive number"; return; }
+    if(!isPositiveIntText(r.fields[3])){ r.error="price must be a positive number"; return; }
+    if(!isValidDate(r.fields[4])){ r.error="invalid date"; return; }
+    if(!isValidTimeHHMM(r.fields[5])){ r.error="invalid departure time"; return; }
+    if(!isValidTimeHHMM(r.fields[6])){ r.error="invalid arrival time"; return; }
+}
+
+void parseScheduleChunk(const vector<string> *lines, vector<ImportRow> *rows, size_t from, size_t to){
+    for(size_t i=from;i<to;i++){
+        (*rows)[i].lineNo=(int)i+1;
+        parseScheduleLine((*lines)[i], (*rows)[i]);
+    }
+}
+
+string routeKey(int fromCity,int toCity,const string &date,const string &dep){
+    return to_string(fromCity)+"|"+to_string(toCity)+"|"+date+"|"+dep;
+}
+
+void bulkImportFlights(){
+    clearLine();
+    string path;
+    cout<<"Schedule file path (0 back): "; getline(cin, path);
+    if(path=="0") return;
+
+    ifstream file(path);
+    if(!file){ cout<<"Cannot open "<<path<<"\n"; return; }
+    vector<string> lines;
+    string line;
+    while(getline(file,line)) lines.push_back(line);
+
+    // Parse + validate in parallel chunks.
+    vector<ImportRow> rows(lines.size());
+    size_t workers=thread::hardware_concurrency();
+    if(workers==0) workers=2;
+    size_t chunk=max((size_t)1000, (lines.size()+workers-1)/workers);
+    vector<thread> pool;
+    for(size_t start=0;start<lines.size();start+=chunk){
+        pool.push_back(thread(parseScheduleChunk, &lines, &rows, start, min(start+chunk, lines.size())));
+    }
+    for(thread &t: pool) t.join();
+
+    // Merge one month partition at a time (file order within it): de-duplicate, assign IDs, append.
+    vector<string> months;
+    unordered_map<string, vector<int> > rowsByMonth;
+    for(size_t i=0;i<rows.size();i++){
+        if(rows[i].skip || !rows[i].error.empty()) continue;
+        string m=monthOf(rows[i].fields[4]);
+        if(!rowsByMonth.count(m)) months.push_back(m);
+        rowsByMonth[m].push_back((int)i);
+    }
+
+    int accepted=0, rejected=0;
+    map<string, vector<int> > newIDsByMonth;
+    for(const string &m: months){
+        int part=getPartition(m);
+        usePartition(part);
+        unordered_map<string,int> existing;     // route+date+time -> flight ID
+        for(int i=0;i<(int)flights.size();i++){
+            if(monthOf(flights[i].date)!=m) continue;
+            existing[routeKey(flights[i].fromCity, flights[i].toCity, flights[i].date, flights[i].departureTime)]=flights[i].id;
+        }
+
+        vector<int> &newIDs=newIDsByMonth[m];
+        for(int ri: rowsByMonth[m]){
+            ImportRow &r=rows[ri];
+            Flight f;
+            f.fromCity=registerCity(r.fields[0]);
+            f.toCity=registerCity(r.fields[1]);
+            string key=routeKey(f.fromCity, f.toCity, r.fields[4], r.fields[5]);
+            unordered_map<string,int>::iterator it=existing.find(key);
+            if(it!=existing.end()){ r.error="duplicate of flight "+to_string(it->second); continue; }
+            if((f.id=generateUniqueFlightID())==-1){ r.error="no free Flight IDs left"; continue; }
+
+            f.from=cityNames[f.fromCity];
+            f.to=cityNames[f.toCity];
+            f.seats=stoi(r.fields[2]);
+            f.price=stoi(r.fields[3]);
+            f.date=r.fields[4];
+            f.departureTime=r.fields[5];
+            f.arrivalTime=r.fields[6];
+            flights.push_back(f);
+            existing[key]=f.id;
+            newIDs.push_back(f.id);
+            accepted++;
+        }
+        if(!newIDs.empty()) flightsChanged(part);
+    }
+
+    // Flight rows first (evicted months were written on eviction), then the
+    // directory in one pass, so it never points at a month missing the row.
+    if(accepted>0) saveFlights();
+    for(map<string, vector<int> >::iterator it=newIDsByMonth.begin();it!=newIDsByMonth.end();++it){
+        for(int id: it->second) fileID(flightDir, id, it->first);
+    }
+    saveDirectory(flightDir);
+
+    ofstream report("import_report.txt");
+    for(ImportRow &r: rows){
+        if(r.skip || r.error.empty()) continue;
+        rejected++;
+        report<<"line "<<r.lineNo<<": "<<r.error<<"\n";
+        if(rejected<=10) cout<<"line "<<r.lineNo<<": "<<r.error<<"\n";
+    }
+    report<<"accepted "<<accepted<<", rejected "<<rejected<<"\n";
+
+    cout<<"Imported "<<accepted<<" flight(s), rejected "<<rejected<<".";
+    if(rejected>0) cout<<" Full report: import_report.txt";
+    cout<<"\n";
 }
 
 void viewPassengers(){
@@ -446,28 +1537,36 @@ void editPassenger(){
 }
 
 void viewAllBookings(){
-    cout<<"\n--- All Bookings (Active + Cancelled + Pending) ---\n";
-    if(bookingCount==0){ cout<<"No bookings found.\n"; return; }
-    for(int i=0;i<bookingCount;i++) printBooking(bookings[i]);
+    cout<<"\n--- All Bookings (Active + Cancelled + Pending + Waitlisted) ---\n";
+    bool found=false;
+    for(int p: partitionsByMonth()){
+        if(!useBookingPartition(p)) continue;
+        for(int i=0;i<(int)bookings.size();i++){
+            if(bookings[i].part==p){ printBooking(bookings[i]); found=true; }
+        }
+    }
+    if(!found) cout<<"No bookings found.\n";
 }
 
 void adminSearchFlights(){
     clearLine();
-    string from, to, date;
+    string date;
 
-    cout << "\nFrom: ";
-    getline(cin, from);
-    cout << "To: ";
-    getline(cin, to);
+    cout << "\n";
+    string typed;
+    int from = readCity("From (0 back): ", false, typed);
+    if(from == -1) return;
+    int to = readCity("To (0 back): ", false, typed);
+    if(to == -1) return;
 
     date = promptUntil("Date (YYYY-MM-DD) (0 back): ", isValidDate, "Invalid date!");
     if(date == "0") return;
 
     bool found = false;
     cout << "\n--- Admin Flight Search Results ---\n";
-    for(int i = 0; i < flightCount; i++){
-        if(flights[i].from == from &&
-           flights[i].to == to &&
+    if(useMonth(monthOf(date))) for(int i = 0; i < (int)flights.size(); i++){
+        if(flights[i].fromCity == from &&
+           flights[i].toCity == to &&
            flights[i].date == date){
             displayFlight(flights[i]);
             found = true;
@@ -479,10 +1578,14 @@ void adminSearchFlights(){
 void approvePendingBookings(){
     cout << "\n--- Pending Bookings ---\n";
     bool found = false;
-    for(int i=0;i<bookingCount;i++){
-        if(bookings[i].status==PENDING){
-            printBooking(bookings[i]);
-            found = true;
+    for(int p: partitionsByMonth()){
+        if(!partitions[p].loaded && partitions[p].pendingRows==0) continue;
+        usePartition(p);
+        for(int i=0;i<(int)bookings.size();i++){
+            if(bookings[i].part==p && bookings[i].status==PENDING){
+                printBooking(bookings[i]);
+                found = true;
+            }
         }
     }
     if(!found){ cout<<"No pending bookings.\n"; return; }
@@ -490,21 +1593,40 @@ void approvePendingBookings(){
     int bid = getValidInt("Enter Booking ID to approve (0 back): ");
     if(bid==0) return;
 
-    for(int i=0;i<bookingCount;i++){
-        if(bookings[i].bookingID==bid && bookings[i].status==PENDING){
-            Flight *f = findFlightByID(bookings[i].flightID);
-            if(!f || f->seats<=0){
-                cout<<"Cannot approve. No seats available.\n";
-                return;
-            }
-
-            bookings[i].status = ACTIVE;
-            f->seats--;
+    int i = findBookingIndex(bid);
+    if(i!=-1 && bookings[i].status==PENDING){
+        Flight *f = findFlightByID(bookings[i].flightID);
+        if(!f){
+            cout<<"Cannot approve. Flight no longer exists.\n";
+            return;
+        }
+        if(f->seats<=0){
+            // already paid: keep its place for the next freed seat
+            joinWaitlist(bookings[i]);
+            bookingsChanged(bookings[i].part);
             saveBookings();
-            saveFlights();
-            cout<<"Booking approved successfully!\n";
+            cout<<"No seats available. Booking moved to the waitlist (#"<<waitlistPosition(bookings[i])<<").\n";
+            return;
+        }
+
+        useTravelWindow(f->date);
+        i = findBookingIndex(bid);
+        f = findFlightByID(bookings[i].flightID);
+        int clash = findScheduleConflict(bookings[i].phone, bookings[i].travellerName, *f, bid);
+        if(clash){
+            cout<<"Cannot approve. Traveller's schedule overlaps booking "<<clash<<":\n";
+            printBooking(bookings[bookingPos[clash]]);
             return;
         }
+
+        bookings[i].status = ACTIVE;
+        f->seats--;
+        bookingsChanged(bookings[i].part);
+        flightsChanged(flightPart(*f));
+        saveBookings();
+        saveFlights();
+        cout<<"Booking approved successfully!\n";
+        return;
     }
     cout<<"Pending booking not found.\n";
 }
@@ -618,17 +1740,20 @@ bool processPayment(const string &method,int amountRs){
 
 void searchFlights(){
     clearLine();
-    string from,to;
-    cout<<"\nFrom: "; getline(cin, from);
-    cout<<"To: "; getline(cin, to);
+    cout<<"\n";
+    string typed;
+    int from=readCity("From (0 back): ", false, typed);
+    if(from==-1) return;
+    int to=readCity("To (0 back): ", false, typed);
+    if(to==-1) return;
 
     string date = promptUntil("Date (YYYY-MM-DD) (0 back): ", isValidDate, "Invalid date!");
     if(date=="0") return;
 
     bool found=false;
     cout<<"\n--- Search Results ---\n";
-    for(int i=0;i<flightCount;i++){
-        if(flights[i].from==from && flights[i].to==to && flights[i].date==date){
+    if(useMonth(monthOf(date))) for(int i=0;i<(int)flights.size();i++){
+        if(flights[i].fromCity==from && flights[i].toCity==to && flights[i].date==date){
             displayFlight(flights[i]);
             found=true;
         }
@@ -637,8 +1762,8 @@ void searchFlights(){
 }
 
 int selectFlightIDFromList(){
-    viewAllFlights();
-    if(flightCount==0) return 0;
+    string month=promptUntil("Travel month (YYYY-MM) (0 back): ", isValidMonth, "Invalid month!");
+    if(month=="0" || viewFlightsOfMonth(month)==0) return 0;
 
     int id=getValidInt("Enter Flight ID to book (0 back): ");
     if(id==0) return 0;
@@ -666,32 +1791,58 @@ void bookTicket(const string &pName,const string &pPhone){
 
     Flight* f=findFlightByID(id);
     if(!f) return;
+    useTravelWindow(f->date);      // so overlapping trips on neighbouring days are indexed
+    f=findFlightByID(id);
 
-    if(f->seats<=0){ cout<<"No seats available!\n"; return; }
     if(checkActiveBookingExists(pName,pPhone,id)){ cout<<"You already booked this flight (ACTIVE).\n"; return; }
-    if(bookingCount>=50){ cout<<"Maximum bookings reached!\n"; return; }
+    if(checkBookingExists(pName,pPhone,id,WAITLISTED)){ cout<<"You are already on this flight's waitlist.\n"; return; }
+
+    string status=PENDING;
+    if(f->seats<=0){
+        cout<<"No seats available! Waitlist length: "<<waitlists[id].size()<<"\n";
+        const string opts[]={"Join Waitlist (pay now, seat given on next cancellation)","Back"};
+        if(runMenu("Flight Full", opts, 2)==2) return;
+        status=WAITLISTED;
+    }
 
     string traveller = chooseTraveller(pName);
+    int clash = findScheduleConflict(pPhone, traveller, *f, 0);
+    if(clash){
+        cout<<"Schedule conflict! "<<traveller<<" is already travelling at that time:\n";
+        printBooking(bookings[bookingPos[clash]]);
+        return;
+    }
 
     string method;
     if(!choosePaymentMethod(method)){ cout<<"Booking cancelled (Back).\n"; return; }
     if(!processPayment(method, f->price)){ cout<<"Booking cancelled because payment failed.\n"; return; }
 
     int bid=generateUniqueBookingID();
-    bookings[bookingCount++] = {bid, pName, pPhone, id, traveller, PENDING, method};
+    if(bid==-1){ cout<<"No free Booking IDs left!\n"; return; }
+    Booking b={bid, pName, pPhone, id, traveller, status, method, 0};
+    addBookingRecord(b, flightPart(*f));
+    addStay(b, *f);
+    bookingsChanged(flightPart(*f));
+    noteAccountMonth(b, monthOf(f->date));
     saveBookings();
+    recordIDs(bookingDir, vector<int>(1, bid), monthOf(f->date));
 
-    cout<<"\nBOOKING CREATED AND PENDING ADMIN APPROVAL!\n";
-    printBooking(bookings[bookingCount-1]);
+    if(status==WAITLISTED) cout<<"\nADDED TO WAITLIST! You will be promoted when a seat frees up.\n";
+    else cout<<"\nBOOKING CREATED AND PENDING ADMIN APPROVAL!\n";
+    printBooking(bookings.back());
 }
 
 void viewMyFlightHistory(const string &pName,const string &pPhone){
-    cout<<"\n--- Your Flight History (Active + Cancelled + Pending) ---\n";
+    cout<<"\n--- Your Flight History (Active + Cancelled + Pending + Waitlisted) ---\n";
     bool found=false;
-    for(int i=0;i<bookingCount;i++){
-        if(bookings[i].accountName==pName && bookings[i].phone==pPhone){
-            printBooking(bookings[i]);
-            found=true;
+    map<string,bool> &months=accountMonths[pName+"|"+pPhone];
+    for(int p: partitionsByMonth()){
+        if(!months.count(partitions[p].month) || !useBookingPartition(p)) continue;
+        for(int i=0;i<(int)bookings.size();i++){
+            if(bookings[i].part==p && bookings[i].accountName==pName && bookings[i].phone==pPhone){
+                printBooking(bookings[i]);
+                found=true;
+            }
         }
     }
     if(!found) cout<<"No history.\n";
@@ -702,28 +1853,36 @@ void cancelBooking(const string &pName,const string &pPhone){
     int bid=getValidInt("Enter Booking ID to cancel (0 back): ");
     if(bid==0) return;
 
-    for(int i=0;i<bookingCount;i++){
-        if(bookings[i].accountName==pName && bookings[i].phone==pPhone &&
-           bookings[i].bookingID==bid && bookings[i].status==ACTIVE){
-
-            bookings[i].status=CANCELLED;
-            Flight* f=findFlightByID(bookings[i].flightID);
-            if(f) f->seats++;
-
-            saveBookings();
-            saveFlights();
-            cout<<"Booking cancelled successfully!\n";
-            return;
+    int i=findBookingIndex(bid);
+    if(i!=-1 && bookings[i].accountName==pName && bookings[i].phone==pPhone &&
+       (bookings[i].status==ACTIVE || bookings[i].status==WAITLISTED)){
+
+        Flight* f=findFlightByID(bookings[i].flightID);
+        if(f) removeStay(bookings[i], *f);
+        if(bookings[i].status==WAITLISTED) removeFromWaitlist(bookings[i]);
+        bool freesSeat = bookings[i].status==ACTIVE;
+        bookings[i].status=CANCELLED;
+        bookingsChanged(bookings[i].part);
+        if(f && freesSeat){
+            f->seats++;
+            promoteFromWaitlist(f);
+            flightsChanged(flightPart(*f));
         }
+
+        saveBookings();
+        saveFlights();
+        cout<<"Booking cancelled successfully!\n";
+        return;
     }
-    cout<<"No ACTIVE booking found with this Booking ID.\n";
+    cout<<"No ACTIVE or WAITLISTED booking found with this Booking ID.\n";
 }
 
 // ===================== MAIN =====================
 int main(){
     srand((unsigned)time(nullptr));
-    loadFlights();
-    loadBookings();
+    initIDAllocator(flightIDs, FLIGHT_ID_MIN, FLIGHT_ID_MAX, SEQUENTIAL_IDS, REUSE_FREED_FLIGHT_IDS);
+    initIDAllocator(bookingIDs, BOOKING_ID_MIN, BOOKING_ID_MAX, SEQUENTIAL_IDS, false);
+    openStorage();
 
     const string mainOpts[]={"Admin","Passenger","Exit"};
 
@@ -735,12 +1894,13 @@ int main(){
 
             const string adminOpts[]={
                 "View Flights","Search Flights","Add Flight (Random ID)","Edit Flight","Delete Flight",
-                "View Passengers","Edit Passenger","View All Bookings","Approve Pending Bookings","Back"
+                "View Passengers","Edit Passenger","View All Bookings","Approve Pending Bookings",
+                "Bulk Import Schedule","Back"
             };
 
             while(true){
-                int c=runMenu("ADMIN MENU", adminOpts, 10);
-                if(c==10) break;
+                int c=runMenu("ADMIN MENU", adminOpts, 11);
+                if(c==11) break;
                 if(c==1) viewAllFlights();
                 else if(c==2) adminSearchFlights();
                 else if(c==3) addFlight();
@@ -750,6 +1910,7 @@ int main(){
                 else if(c==7) editPassenger();
                 else if(c==8) viewAllBookings();
                 else if(c==9) approvePendingBookings();
+                else if(c==10) bulkImportFlights();
             }
         }
         else if(userType==2){